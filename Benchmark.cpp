@@ -0,0 +1,147 @@
+/*** INCLUDES ***/
+#include "Benchmark.h"
+
+#ifdef BENCHMARK_ENABLED
+
+#include <stdio.h>
+#include <string.h>
+#ifndef ARDUINO
+  #include <chrono>
+#endif //ARDUINO
+#include "Davis_Data.h"
+#include "MQTT_Payload.h"
+
+/*** DEFINES ***/
+#define BENCHMARK_EPOCH_TIME      1557668700UL    // 2019-05-12 13:45:00, fixed instead of the NTP time
+
+/*** PUBLIC VARIABLES ***/
+volatile uint32_t g_BenchmarkSink;
+
+/*** PRIVATE VARIABLES ***/
+static LoopPacket   s_BenchLoop;
+static Loop2Packet  s_BenchLoop2;
+static ArchivePage  s_BenchPage;
+
+/*** PUBLIC FUNCTIONS ***/
+void Benchmark_Run(BenchmarkResults *outResults)
+{
+  outResults->StateJsonUs = BENCHMARK_NOT_RUN;
+  outResults->CmdGetArchiveUs = BENCHMARK_NOT_RUN;
+  outResults->CmdSetTimeUs = BENCHMARK_NOT_RUN;
+
+  // fill the input packets with the same pseudo-random bytes on every run (xorshift32)
+  uint32_t lvSeed = BENCHMARK_SEED;
+  uint8_t *lvPackets[] = { (uint8_t*)&s_BenchLoop, (uint8_t*)&s_BenchLoop2, (uint8_t*)&s_BenchPage };
+  uint16_t lvPacketSizes[] = { sizeof(s_BenchLoop), sizeof(s_BenchLoop2), sizeof(s_BenchPage) };
+  for (int p = 0; p < 3; p++)
+  {
+    for (int i = 0; i < lvPacketSizes[p]; i++)
+    {
+      lvSeed ^= lvSeed << 13;
+      lvSeed ^= lvSeed >> 17;
+      lvSeed ^= lvSeed << 5;
+      lvPackets[p][i] = (uint8_t)lvSeed;
+    }
+  }
+  // archive records need a sane date/time stamp for the topic formatting
+  for (int j = 0; j < 5; j++)
+  {
+    s_BenchPage.Record[j].DateStamp = DATE_TO_DATESTAMP(12, 5, 2019);
+    s_BenchPage.Record[j].TimeStamp = TIME_TO_TIMESTAMP(13, j*5);
+  }
+
+  BENCHMARK_STAGE(outResults->CrcLoopUs,    g_BenchmarkSink += CalcCrc((uint8_t*)&s_BenchLoop, sizeof(LoopPacket)));
+  BENCHMARK_STAGE(outResults->CrcLoop2Us,   g_BenchmarkSink += CalcCrc((uint8_t*)&s_BenchLoop2, sizeof(Loop2Packet)));
+  BENCHMARK_STAGE(outResults->CrcArchiveUs, g_BenchmarkSink += CalcCrc((uint8_t*)&s_BenchPage, sizeof(ArchivePage)));
+
+  // conversions write to a scratch struct, which then also feeds the state serialization
+  StationData lvStationData;
+  memset(&lvStationData, 0, sizeof(lvStationData));
+  BENCHMARK_STAGE(outResults->ConvertLoopUs,  g_BenchmarkSink += Davis_ConvertLoopData(&s_BenchLoop, &lvStationData));
+  BENCHMARK_STAGE(outResults->ConvertLoop2Us, g_BenchmarkSink += Davis_ConvertLoop2Data(&s_BenchLoop2, &lvStationData));
+
+  // per-page work of STATE_GET_ARCHIVE_DATA, minus the publish
+  BENCHMARK_STAGE(outResults->ArchiveDecodeUs,
+  {
+    for (int j = 0; j < 5; j++)
+    {
+      ArchiveRecordRevB *lvArchiveRecord = &s_BenchPage.Record[j];
+      if (lvArchiveRecord->DateStamp != 0xFFFF)
+      {
+        char lvTopic[128];
+        Davis_FormatArchiveTopic(lvArchiveRecord, lvTopic, sizeof(lvTopic));
+        g_BenchmarkSink += lvTopic[sizeof(MQTT_TOPIC_ARCHIVE)];
+      }
+    }
+  });
+
+#ifdef WIFI_ENABLED
+  // state serialization, same steps as MQTT_SendState() minus the publish
+  BENCHMARK_STAGE(outResults->StateJsonUs,
+  {
+    StaticJsonBuffer<JSON_BUFFER_SIZE> lvJSONBuffer;
+    JsonObject& lvRoot = lvJSONBuffer.createObject();
+    MQTT_FillState(lvRoot, &lvStationData, BENCHMARK_EPOCH_TIME);
+    char lvBuffer[MQTT_MAX_PACKET_SIZE];
+    g_BenchmarkSink += lvRoot.printTo(lvBuffer, sizeof(lvBuffer));
+  });
+
+  // date/time argument parsing of the get_archive/set_time handlers only, the topic strcmp, command
+  // dispatch and payload copy of MQTT_Callback() are not included (it needs a live PubSubClient).
+  // Parses into a local struct, so no archive download or time change gets triggered.
+  DateTimeStruct lvDateTime;
+  BENCHMARK_STAGE(outResults->CmdGetArchiveUs,
+  {
+    g_BenchmarkSink += MQTT_ParseDateTimeCommand(MQTT_CMD_GET_ARCHIVE " 2019-05-12 13:45:00", MQTT_CMD_GET_ARCHIVE, &lvDateTime);
+  });
+  BENCHMARK_STAGE(outResults->CmdSetTimeUs,
+  {
+    g_BenchmarkSink += MQTT_ParseDateTimeCommand(MQTT_CMD_SET_TIME " 2019-05-12 13:45:00", MQTT_CMD_SET_TIME, &lvDateTime);
+  });
+#endif //WIFI_ENABLED
+}
+
+void Benchmark_ToJson(const BenchmarkResults *inResults, char *outBuffer, uint16_t inMaxLength)
+{
+  const struct {
+    const char *Name;
+    float       Value;
+  } lvStages[] = {
+    {"CrcLoopUs",       inResults->CrcLoopUs},
+    {"CrcLoop2Us",      inResults->CrcLoop2Us},
+    {"CrcArchiveUs",    inResults->CrcArchiveUs},
+    {"ConvertLoopUs",   inResults->ConvertLoopUs},
+    {"ConvertLoop2Us",  inResults->ConvertLoop2Us},
+    {"StateJsonUs",     inResults->StateJsonUs},
+    {"ArchiveDecodeUs", inResults->ArchiveDecodeUs},
+    {"CmdGetArchiveUs", inResults->CmdGetArchiveUs},
+    {"CmdSetTimeUs",    inResults->CmdSetTimeUs}
+  };
+
+  int lvLength = snprintf(outBuffer, inMaxLength, "{\"Target\":\"%s\",\"Iterations\":%lu,\"Seed\":%lu",
+                          BENCHMARK_TARGET, (unsigned long)BENCHMARK_ITERATIONS, (unsigned long)BENCHMARK_SEED);
+  for (unsigned int i = 0; (i < sizeof(lvStages)/sizeof(lvStages[0])) && (lvLength >= 0) && (lvLength < inMaxLength); i++)
+  {
+    if (lvStages[i].Value < 0.0f)
+    {
+      lvLength += snprintf(outBuffer + lvLength, inMaxLength - lvLength, ",\"%s\":null", lvStages[i].Name);
+    }
+    else
+    {
+      lvLength += snprintf(outBuffer + lvLength, inMaxLength - lvLength, ",\"%s\":%.4f", lvStages[i].Name, lvStages[i].Value);
+    }
+  }
+  if ((lvLength >= 0) && (lvLength < inMaxLength))
+  {
+    snprintf(outBuffer + lvLength, inMaxLength - lvLength, "}");
+  }
+}
+
+#ifndef ARDUINO
+unsigned long Benchmark_HostMicros(void)
+{
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif //ARDUINO
+
+#endif //BENCHMARK_ENABLED
@@ -0,0 +1,61 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+#ifdef BENCHMARK_ENABLED
+
+/*** DEFINES ***/
+#ifdef ARDUINO
+  #include <Arduino.h>
+  #define BENCHMARK_MICROS()        micros()
+  #define BENCHMARK_YIELD()         yield()     // keep the watchdog fed between stages
+  #define BENCHMARK_TARGET          "arduino"
+#else
+  #define BENCHMARK_MICROS()        Benchmark_HostMicros()
+  #define BENCHMARK_YIELD()
+  #define BENCHMARK_TARGET          "host"
+#endif //ARDUINO
+
+// runs stmt BENCHMARK_ITERATIONS times and stores the average time per call in microseconds
+#define BENCHMARK_STAGE(result, stmt) { \
+    unsigned long lvStartUs = BENCHMARK_MICROS(); \
+    for (uint32_t n = 0; n < BENCHMARK_ITERATIONS; n++) { \
+      stmt; \
+    } \
+    result = (float)(BENCHMARK_MICROS() - lvStartUs) / BENCHMARK_ITERATIONS; \
+    BENCHMARK_YIELD(); \
+  }
+
+#define BENCHMARK_NOT_RUN         (-1.0f)     // stage not part of this build, reported as null
+
+/*** TYPE DEFINITIONS ***/
+// average time per call in microseconds
+typedef struct
+{
+  float     CrcLoopUs;
+  float     CrcLoop2Us;
+  float     CrcArchiveUs;
+  float     ConvertLoopUs;
+  float     ConvertLoop2Us;
+  float     StateJsonUs;
+  float     ArchiveDecodeUs;
+  float     CmdGetArchiveUs;
+  float     CmdSetTimeUs;
+} BenchmarkResults;
+
+/*** PUBLIC VARIABLES ***/
+// results of the timed calls are added here, so the compiler cannot drop them
+extern volatile uint32_t g_BenchmarkSink;
+
+/*** PUBLIC FUNCTIONS ***/
+void Benchmark_Run(BenchmarkResults *outResults);
+void Benchmark_ToJson(const BenchmarkResults *inResults, char *outBuffer, uint16_t inMaxLength);
+#ifndef ARDUINO
+  unsigned long Benchmark_HostMicros(void);
+#endif //ARDUINO
+
+#endif //BENCHMARK_ENABLED
+
+#endif //BENCHMARK_H
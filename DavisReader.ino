@@ -2,6 +2,11 @@
 /*** INCLUDES ***/
 #include <SoftwareSerial.h>
 #include "WiFi_MQTT.h"
+#include "Davis_Data.h"
+#include "Benchmark.h"
+#ifdef FAST_BOOT_ENABLED
+  #include <EEPROM.h>
+#endif //FAST_BOOT_ENABLED
 
 /*** DEFINES***/
 #define DAVIS_WRITE(a)             Serial.print(a)
@@ -24,6 +29,7 @@
 #define DAVIS_COMMAND_TIMEOUT_MS        500
 #define DAVIS_BYTE_TIMEOUT_MS           50
 #define DAVIS_LOOP_COMMAND_TIMEOUT_MS  3000
+#define DAVIS_INIT_RETRY_MS            2000
 
 // Forecast Icons
 #define FORECAST_ICON_RAIN        0x01
@@ -32,25 +38,6 @@
 #define FORECAST_ICON_SUN         0x08
 #define FORECAST_ICON_SNOW        0x10
 
-// Data conversion macros
-#define DAVIS_CONVERT_TEMPERATURE_10TH(raw)      (((((float)raw / 10.0f) - 32.0f) * 5.0f) / 9.0f)
-#define DAVIS_CONVERT_EXTRA_TEMPERATURE(raw)     (((((float)raw - 90.0f) - 32.0f) * 5.0f) / 9.0f)
-#define DAVIS_CONVERT_WINDSPEED(mph)             ((float)mph * 1.609344f)
-#define DAVIS_CONVERT_RAINRATE(clicks)           ((float)clicks * 0.2f)
-#define DAVIS_CONVERT_BATT_VOLTAGE(raw)          ((((float)raw * 300.0f)/512.0f)/100.0)
-#define DAVIS_CONVERT_BAR_PRESSURE(raw)          ((((float)raw * 33.86389f) / 1000.0))
-#define DAVIS_CONVERT_DEW_POINT(raw)             ((((float)raw - 32.0f) * 5.0f) / 9.0f)
-
-
-#define DATE_TO_DATESTAMP(d,m,y)      (uint16_t)((uint16_t)d + m*32 + (y-2000)*512)
-#define TIME_TO_TIMESTAMP(h,m)        (uint16_t)((uint16_t)h*100 + m)
-
-#define DATESTAMP_DAY(ds)             (uint8_t)(ds & 0x1F)
-#define DATESTAMP_MONTH(ds)           (uint8_t)((ds >> 5) & 0x0F)
-#define DATESTAMP_YEAR(ds)            (uint16_t)(((ds >> 9) & 0x7F) + 2000)
-#define TIMESTAMP_HOUR(ts)            (uint8_t)(ts/100)
-#define TIMESTAMP_MIN(ts)             (uint8_t)(ts - (100*(ts/100)))
-
 #define DUMP_BYTES(buf, cnt, dbg_type)    \
     if (dbg_type & DEBUG_HEX) { \
       for (int i = 0; i < cnt; i++) { \
@@ -92,166 +79,18 @@ typedef enum {
   RESP_TIMEOUT
 } DavisCommandResponse;
 
-#pragma pack(push)
-#pragma pack(1)
-typedef struct 
-{
-  uint8_t Seconds;
-  uint8_t Minutes;
-  uint8_t Hours;
-  uint8_t Day;
-  uint8_t Month;
-  uint8_t Year;
-  uint16_t CRC;
-} TimePacket __attribute__((packed));
-
-typedef struct 
-{
-  uint8_t   Identifier[3];  // 0
-  uint8_t   BarTrend;       // 3
-  uint8_t   PacketType;     // 4
-  uint16_t  NextRecord;     // 5
-  int16_t   Barometer;      // 7
-  int16_t   InTemperature;  // 9
-  uint8_t   InHumidity;     // 11
-  int16_t   OutTemperature; // 12
-  uint8_t   WindSpeed;      // 14
-  uint8_t   AvgWindSpeed;   // 15
-  uint16_t  WindDirection;  // 16
-  uint8_t   ExtraTemps[7];  // 18
-  uint8_t   SoilTemps[4];   // 25
-  uint8_t   LeafTemps[4];   // 29
-  uint8_t   OutHumidity;    // 33
-  uint8_t   ExtraHumidity[7];// 34
-  uint16_t  RainRate;       // 41
-  uint8_t   UVindex;        // 42
-  uint16_t  SolarRadiation; // 44
-  uint16_t  StormRain;      // 46
-  uint16_t  StormDate;      // 48
-  uint16_t  RainDay;        // 50
-  uint16_t  RainMonth;      // 52
-  uint16_t  RainYear;       // 54
-  uint16_t  ET_Day;         // 56
-  uint16_t  ET_Month;       // 58
-  uint16_t  ET_Year;        // 60
-  uint8_t   SoilMoisture[4];// 62
-  uint8_t   LeafWetness[4]; // 66
-  uint8_t   Alarms_Inside;  // 70
-  uint8_t   Alarms_Rain;            // 71
-  uint8_t   Alarms_Outside[2];      // 72
-  uint8_t   Alarms_ExtraTempHum[8]; // 74
-  uint8_t   Alarms_SoilLeaf[4];     // 82
-  uint8_t   Battery_Transmitter;    // 86
-  uint16_t  Battery_Console;        // 87
-  uint8_t   ForecastIcons;          // 89
-  uint8_t   ForecastRule;           // 90
-  uint16_t  TimeSunrise;            // 91
-  uint16_t  TimeSunset;             // 93
-  uint8_t   LF;                     // 95
-  uint8_t   CR;                     // 96
-  uint16_t  CRC;                    // 97
-} LoopPacket __attribute__((packed));
-
-typedef struct 
-{
-  uint8_t   Identifier[3];  // 0
-  uint8_t   BarTrend;       // 3
-  uint8_t   PacketType;     // 4
-  uint16_t  Unused;         // 5
-  int16_t   Barometer;      // 7
-  int16_t   InTemperature;  // 9
-  uint8_t   InHumidity;     // 11
-  int16_t   OutTemperature; // 12
-  uint8_t   WindSpeed;      // 14
-  uint8_t   Unused2;        // 15
-  uint16_t  WindDirection;  // 16
-  uint16_t  AvgWindSpeed10; // 18
-  uint16_t  AvgWindSpeed2;  // 20
-  uint16_t  AvgWindGust;    // 22
-  uint16_t  WindGustDirection;   // 24
-  uint8_t   Unused3[4];     // 26
-  int16_t   DewPoint;       // 30
-  uint8_t   Unused4;        // 32
-  uint8_t   OutHumidity;    // 33
-  uint8_t   Unused5;        // 34
-  int16_t   HeatIndex;      // 35
-  int16_t   WindChill;      // 37
-  int16_t   THSWIndex;      // 39
-  uint16_t  RainRate;       // 41
-  uint8_t   UVindex;        // 42
-  uint16_t  SolarRadiation; // 44
-  uint16_t  StormRain;      // 46
-  uint16_t  StormDate;      // 48
-  uint16_t  RainDay;        // 50
-  uint16_t  Rain15Min;      // 52
-  uint16_t  RainHour;       // 54
-  uint16_t  ET_Day;         // 56
-  uint16_t  Rain24Hrs;      // 58
-  uint8_t   BarReduction;   // 60
-  uint16_t  BarOffset;      // 61
-  uint16_t  BarCalibNr;     // 63
-  uint16_t  BarRaw;         // 65
-  uint16_t  BarAbs;         // 67
-  uint16_t  Altimeter;      // 69
-  uint8_t   Unused6[2];     // 71
-  uint8_t   Next10minWindGPtr;    // 73
-  uint8_t   Next15minWindGPtr;    // 74
-  uint8_t   NextHourlyWindGPtr;   // 75
-  uint8_t   NextDailyWindGPtr;    // 76
-  uint8_t   NextMinuteRainGPtr;   // 77
-  uint8_t   NextStormRainGPtr;    // 78
-  uint8_t   MinuteIndex;          // 79
-  uint8_t   NextMonthlyRain;      // 80
-  uint8_t   NextYearlyRain;       // 81
-  uint8_t   NextSeasonalRain;     // 82
-  uint8_t   Unused7[2*6];         // 83
-  uint8_t   LF;                     // 95
-  uint8_t   CR;                     // 96
-  uint16_t  CRC;                    // 97
-} Loop2Packet __attribute__((packed));
-
-typedef struct 
-{
-  uint16_t  DateStamp;      // 0
-  uint16_t  TimeStamp;      // 2
-  int16_t   OutTemperature; // 4
-  int16_t   OutTempHigh;    // 6
-  int16_t   OutTempLow;     // 8
-  uint16_t  RainFall;       // 10
-  uint16_t  HighRainRate;   // 12
-  uint16_t  Barometer;      // 14
-  uint16_t  SolarRadiation; // 16
-  uint16_t  WindSamples;    // 18
-  int16_t   InTemperature;  // 20
-  uint8_t   InHumidity;     // 22
-  uint8_t   OutHumidity;    // 23
-  uint8_t   AvgWindSpeed;   // 24
-  uint8_t   HighWindSpeed;  // 25
-  uint8_t   HighWindDirection;  // 26
-  uint8_t   PrevWindDirection;  // 27
-  uint8_t   AvgUVIndex;     // 28
-  uint8_t   ET;             // 29
-  uint16_t  HighSolarRadiation; // 30
-  uint8_t   HighUVIndex;    // 32
-  uint8_t   ForecastRule;   // 33
-  uint8_t   LeafTemp[2];    // 34
-  uint8_t   LeafWetness[2]; // 36
-  uint8_t   SoilTemp[4];    // 38
-  uint8_t   RecordType;     // 42
-  uint8_t   ExtraHum[2];    // 43
-  uint8_t   ExtraTemp[3];   // 45
-  uint8_t   SoilMoisture[4];// 48
-} ArchiveRecordRevB __attribute__((packed));
-
-typedef struct 
+#ifdef FAST_BOOT_ENABLED
+typedef struct
 {
-  uint8_t           SeqNr;      // 0
-  ArchiveRecordRevB Record[5];  // 1
-  uint8_t           Unused[4];  // 261
-  uint16_t          CRC;        // 265
-} ArchivePage __attribute__((packed));
+  uint32_t  Magic;
+  char      FWDate[32];
+  char      FWVersion[32];
+  uint8_t   Receivers;
+  Settings  UserSettings;
+  uint16_t  CRC;
+} BootCache;
+#endif //FAST_BOOT_ENABLED
 
-#pragma pack(pop)
 /*** GLOBAL VARIABLES ***/
 SoftwareSerial g_DebugSerial(3, 1); // RX, TX
 
@@ -271,9 +110,22 @@ bool g_GetTimeCommand;
 bool g_SetTimeCommand;
 DateTimeStruct g_DateTimeStruct;
 
+BootMetrics g_BootMetrics;
+
+#ifdef BENCHMARK_ENABLED
+bool g_BenchmarkCommand = false;
+#endif //BENCHMARK_ENABLED
+
 /*** PRIVATE VARIABLES ***/
 static unsigned long s_PrevTimeMs;
 static bool s_InitOk = false;
+static unsigned long s_InitRetryTime = 0;
+
+#ifdef FAST_BOOT_ENABLED
+static BootCache s_BootCache;
+static bool s_FastBoot = false;
+static bool s_IdentityRefreshPending = false;
+#endif //FAST_BOOT_ENABLED
 
 static struct {
   uint8_t Value;
@@ -290,59 +142,13 @@ static struct {
   {0x17 ,"Partly Cloudy, Rain or Snow within 12 hours"}
 };
 
-// CRC table
-static const uint16_t s_CRC_TABLE [] = {
-  0x0, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
-  0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
-  0x1231, 0x210, 0x3273, 0x2252, 0x52b5, 0x4294, 0x72f7, 0x62d6,
-  0x9339, 0x8318, 0xb37b, 0xa35a, 0xd3bd, 0xc39c, 0xf3ff, 0xe3de,
-  0x2462, 0x3443, 0x420, 0x1401, 0x64e6, 0x74c7, 0x44a4, 0x5485,
-  0xa56a, 0xb54b, 0x8528, 0x9509, 0xe5ee, 0xf5cf, 0xc5ac, 0xd58d,
-  0x3653, 0x2672, 0x1611, 0x630, 0x76d7, 0x66f6, 0x5695, 0x46b4,
-  0xb75b, 0xa77a, 0x9719, 0x8738, 0xf7df, 0xe7fe, 0xd79d, 0xc7bc,
-  0x48c4, 0x58e5, 0x6886, 0x78a7, 0x840, 0x1861, 0x2802, 0x3823,
-  0xc9cc, 0xd9ed, 0xe98e, 0xf9af, 0x8948, 0x9969, 0xa90a, 0xb92b,
-  0x5af5, 0x4ad4, 0x7ab7, 0x6a96, 0x1a71, 0xa50, 0x3a33, 0x2a12,
-  0xdbfd, 0xcbdc, 0xfbbf, 0xeb9e, 0x9b79, 0x8b58, 0xbb3b, 0xab1a,
-  0x6ca6, 0x7c87, 0x4ce4, 0x5cc5, 0x2c22, 0x3c03, 0xc60, 0x1c41,
-  0xedae, 0xfd8f, 0xcdec, 0xddcd, 0xad2a, 0xbd0b, 0x8d68, 0x9d49,
-  0x7e97, 0x6eb6, 0x5ed5, 0x4ef4, 0x3e13, 0x2e32, 0x1e51, 0xe70,
-  0xff9f, 0xefbe, 0xdfdd, 0xcffc, 0xbf1b, 0xaf3a, 0x9f59, 0x8f78,
-  0x9188, 0x81a9, 0xb1ca, 0xa1eb, 0xd10c, 0xc12d, 0xf14e, 0xe16f,
-  0x1080, 0xa1, 0x30c2, 0x20e3, 0x5004, 0x4025, 0x7046, 0x6067,
-  0x83b9, 0x9398, 0xa3fb, 0xb3da, 0xc33d, 0xd31c, 0xe37f, 0xf35e,
-  0x2b1, 0x1290, 0x22f3, 0x32d2, 0x4235, 0x5214, 0x6277, 0x7256,
-  0xb5ea, 0xa5cb, 0x95a8, 0x8589, 0xf56e, 0xe54f, 0xd52c, 0xc50d,
-  0x34e2, 0x24c3, 0x14a0, 0x481, 0x7466, 0x6447, 0x5424, 0x4405,
-  0xa7db, 0xb7fa, 0x8799, 0x97b8, 0xe75f, 0xf77e, 0xc71d, 0xd73c,
-  0x26d3, 0x36f2, 0x691, 0x16b0, 0x6657, 0x7676, 0x4615, 0x5634,
-  0xd94c, 0xc96d, 0xf90e, 0xe92f, 0x99c8, 0x89e9, 0xb98a, 0xa9ab,
-  0x5844, 0x4865, 0x7806, 0x6827, 0x18c0, 0x8e1, 0x3882, 0x28a3,
-  0xcb7d, 0xdb5c, 0xeb3f, 0xfb1e, 0x8bf9, 0x9bd8, 0xabbb, 0xbb9a,
-  0x4a75, 0x5a54, 0x6a37, 0x7a16, 0xaf1, 0x1ad0, 0x2ab3, 0x3a92,
-  0xfd2e, 0xed0f, 0xdd6c, 0xcd4d, 0xbdaa, 0xad8b, 0x9de8, 0x8dc9,
-  0x7c26, 0x6c07, 0x5c64, 0x4c45, 0x3ca2, 0x2c83, 0x1ce0, 0xcc1,
-  0xef1f, 0xff3e, 0xcf5d, 0xdf7c, 0xaf9b, 0xbfba, 0x8fd9, 0x9ff8,
-  0x6e17, 0x7e36, 0x4e55, 0x5e74, 0x2e93, 0x3eb2, 0xed1, 0x1ef0,
-  };
-
 static uint16_t s_ArchivePageNr = 0;
 static uint16_t s_ArchivePageCount = 0;
 static uint16_t s_ArchiveRecordStart = 0;
 static uint8_t s_ArchivePageBuf[sizeof(ArchivePage)];
 
 /*** PRIVATE FUNCTIONS ***/
-uint16_t CalcCrc(uint8_t * inDataPtr, uint16_t inSize)
-{
-  uint16_t lvCRC = 0;
-  for (int i = 0; i < inSize; i++)
-  {
-    lvCRC = s_CRC_TABLE[(lvCRC >> 8) ^ inDataPtr[i]] ^ (lvCRC << 8);
-  }
-  return lvCRC;
-}
-
-static bool Davis_Init(void);
+static bool Davis_Init(bool inUseCachedIdentity = false);
 static bool Davis_SetTime(uint16_t inYear, uint8_t inMonth, uint8_t inDay, uint8_t inHours, uint8_t inMinutes, uint8_t inSeconds);
 static bool Davis_GetTime(uint16_t *outYear=0, uint8_t *outMonth=0, uint8_t *outDay=0, uint8_t *outHours=0, uint8_t *outMinutes=0, uint8_t *outSeconds=0);
 static bool Davis_SetTime(DateTimeStruct *inDateTimeStruct);
@@ -360,14 +166,19 @@ static bool Davis_ReadByte(uint8_t *outByte, DebugType inDebug = DEBUG_HEX);
 static bool Davis_SendCommand(const char *inCommand, char *outResponse, uint16_t inMaxResponseLength, bool inBinaryResponse=false, uint16_t inTimeoutMs = DAVIS_COMMAND_TIMEOUT_MS);
 static uint16_t Davis_SendRawCommand(const char *inCommand, char *outResponse, uint16_t inMaxResponseLength, uint16_t inByteTimeoutMs = DAVIS_BYTE_TIMEOUT_MS);
 static bool Davis_WakeUp(void);
-static bool Davis_ConvertLoopData(LoopPacket* inLoopPacket, StationData * outStationData);
-static bool Davis_ConvertLoop2Data(Loop2Packet* inLoopPacket, StationData * outStationData);
 
 static bool Davis_StartReadArchiveData(uint16_t *outPageCount, uint16_t *outFirstRecord, uint16_t inYear = 2000, uint8_t inMonth = 1, uint8_t inDay = 1, uint8_t inHour = 0, uint8_t inMinute = 0);
 static bool Davis_StartReadArchiveData(uint16_t *outPageCount, uint16_t *outFirstRecord, uint16_t inDateStamp, uint16_t inTimeStamp);
 static void Davis_StoptReadArchiveData();
 static bool Davis_ContinueReadArchiveData(ArchivePage **outArchivePage, uint16_t *outPageNr, uint8_t inRetries);
 
+#ifdef FAST_BOOT_ENABLED
+static bool BootCache_IsWarmReset(uint8_t inResetReason);
+static bool BootCache_Load(void);
+static void BootCache_Apply(bool inApplyIdentity);
+static void BootCache_Update(void);
+#endif //FAST_BOOT_ENABLED
+
 void setup() 
 {
   // put your setup code here, to run once:
@@ -379,10 +190,26 @@ void setup()
   // D1 is the VCC for the RS232 transceiver
   pinMode(D1, OUTPUT);
   digitalWrite(D1, HIGH);   // turn the RS232 transceiver on
+
+  g_BootMetrics.ResetReason = ESP.getResetInfoPtr()->reason;
+#ifdef FAST_BOOT_ENABLED
+  EEPROM.begin(sizeof(BootCache));
+  // always load the cache, so BootCache_Update() can tell whether a flash write is needed
+  if (BootCache_Load())
+  {
+    // settings are restored on every boot, the console identity only after a warm reset
+    s_FastBoot = BootCache_IsWarmReset(g_BootMetrics.ResetReason);
+    BootCache_Apply(s_FastBoot);
+  }
+  g_BootMetrics.FastBoot = s_FastBoot;
+  delay(s_FastBoot ? FAST_BOOT_SETTLE_MS : 1000);
+#else
   delay(1000);
+#endif //FAST_BOOT_ENABLED
   
    // set the data rate for the SoftwareSerial port
   g_DebugSerial.begin(19200);
+  MSG_DBG("Reset reason: %d, fast boot: %s", g_BootMetrics.ResetReason, g_BootMetrics.FastBoot ? "yes" : "no");
   
   s_PrevTimeMs = millis();
 
@@ -409,6 +236,9 @@ static State s_State = STATE_INIT;
 void loop() 
 {
   static unsigned long s_LastUpdateTime = 0;
+#ifdef FAST_BOOT_ENABLED
+  static bool s_PolledOffline = false;
+#endif //FAST_BOOT_ENABLED
   static bool s_Once = false;
 #ifdef WIFI_ENABLED
   WiFi_MQTT_Tick();
@@ -417,16 +247,29 @@ void loop()
   switch (s_State)
   {
     case STATE_INIT:
-      if (Davis_Init())
-      {
-        MSG_DBG("Davis Init OK!");
-        s_InitOk = true;
-        MQTT_SendConfig();
-        s_State = STATE_IDLE;
-      }
-      else
+      // retry without blocking, so WiFi/MQTT bring-up keeps running in the meantime
+      if ((s_InitRetryTime == 0) || ((millis() - s_InitRetryTime) >= DAVIS_INIT_RETRY_MS))
       {
-        delay(2000);
+#ifdef FAST_BOOT_ENABLED
+        bool lvInitOk = Davis_Init(s_FastBoot);
+#else
+        bool lvInitOk = Davis_Init();
+#endif //FAST_BOOT_ENABLED
+        if (lvInitOk)
+        {
+          MSG_DBG("Davis Init OK!");
+          s_InitOk = true;
+          g_BootMetrics.ConsoleReadyMs = millis();
+#ifdef FAST_BOOT_ENABLED
+          s_IdentityRefreshPending = s_FastBoot;
+#endif //FAST_BOOT_ENABLED
+          MQTT_SendConfig();
+          s_State = STATE_IDLE;
+        }
+        else
+        {
+          s_InitRetryTime = millis();
+        }
       }
       break;
     case STATE_IDLE:
@@ -441,12 +284,37 @@ void loop()
           g_CustomCommandPending = false;
         }
       }
-      if ((s_LastUpdateTime == 0) || ((millis() - s_LastUpdateTime) >= (unsigned long)g_Settings.UpdateIntervalSec * 1000))
+      bool lvPollDue;
+      lvPollDue = (s_LastUpdateTime == 0) || ((millis() - s_LastUpdateTime) >= (unsigned long)g_Settings.UpdateIntervalSec * 1000);
+#ifdef FAST_BOOT_ENABLED
+      if (g_BootMetrics.FirstPublishMs == 0)
+      {
+        if (!WiFi_MQTT_IsConnected())
+        {
+          // hold back the first sample until MQTT is up, so it is not read just to be dropped
+          if ((s_LastUpdateTime == 0) && (millis() < FAST_BOOT_MQTT_WAIT_MS))
+          {
+            lvPollDue = false;
+          }
+        }
+        else if (s_PolledOffline)
+        {
+          // earlier samples could not be published, don't wait for the next interval
+          lvPollDue = true;
+        }
+      }
+#endif //FAST_BOOT_ENABLED
+      if (lvPollDue)
       {
         s_LastUpdateTime = millis();
+#ifdef FAST_BOOT_ENABLED
+        s_PolledOffline = !WiFi_MQTT_IsConnected();
+#endif //FAST_BOOT_ENABLED
         if (Davis_WakeUp())
         {
           bool lvSendUpdate = false;
+          // no pacing delays for the first sample, so it goes out as soon as it is read
+          bool lvPace = (g_BootMetrics.FirstPublishMs != 0);
           char lvLoopResponse[sizeof(LoopPacket)];
           uint16_t lvCRC;
           if (Davis_SendCommand("LOOP 1", lvLoopResponse, sizeof(LoopPacket), true, DAVIS_LOOP_COMMAND_TIMEOUT_MS))
@@ -458,7 +326,10 @@ void loop()
               if (Davis_ConvertLoopData(lvLoopPacket, &g_StationData))
               {
                 MQTT_SendRaw(MQTT_TOPIC_RAW_LOOP, (uint8_t*)lvLoopPacket, sizeof(LoopPacket));
-                delay(500);
+                if (lvPace)
+                {
+                  delay(500);
+                }
                 lvSendUpdate = true;
               }
               else
@@ -485,7 +356,10 @@ void loop()
                 if (Davis_ConvertLoop2Data(lvLoop2Packet, &g_StationData))
                 {
                   MQTT_SendRaw(MQTT_TOPIC_RAW_LOOP2, (uint8_t*)lvLoop2Packet, sizeof(Loop2Packet));
-                  delay(500);
+                  if (lvPace)
+                  {
+                    delay(500);
+                  }
                   lvSendUpdate = true;
                 }
                 else
@@ -499,10 +373,18 @@ void loop()
               }
             }
           }
-          delay(1000);
+          if (lvPace)
+          {
+            delay(1000);
+          }
           if (lvSendUpdate)
           {
-            MQTT_SendState();
+            if (MQTT_SendState() && (g_BootMetrics.FirstPublishMs == 0))
+            {
+              g_BootMetrics.FirstPublishMs = millis();
+              MSG_DBG("Time to first publish: %lu ms", (unsigned long)g_BootMetrics.FirstPublishMs);
+              MQTT_SendBootMetrics();
+            }
           }
         }
         else
@@ -510,6 +392,21 @@ void loop()
           MSG_DBG("Could not wake-up Davis");
         }
       }
+#ifdef FAST_BOOT_ENABLED
+      if (s_IdentityRefreshPending && (g_BootMetrics.FirstPublishMs != 0))
+      {
+        // first sample is out, now re-query the console identity that was taken from the boot cache
+        s_IdentityRefreshPending = false;
+        if (Davis_Init())
+        {
+          MQTT_SendConfig();
+        }
+      }
+      if ((s_BootCache.Magic == FAST_BOOT_CACHE_MAGIC) && (memcmp(&s_BootCache.UserSettings, &g_Settings, sizeof(Settings)) != 0))
+      {
+        BootCache_Update();
+      }
+#endif //FAST_BOOT_ENABLED
       if (g_TriggerArchiveDownload || g_TriggerArchiveDownloadWithDateTime)
       {
         if (Davis_WakeUp())
@@ -579,6 +476,19 @@ void loop()
         MQTT_SendRaw(MQTT_TOPIC_RESP, (uint8_t*)lvResponse, strlen(lvResponse));        
         g_SetTimeCommand = false;        
       }
+#ifdef BENCHMARK_ENABLED
+      if (g_BenchmarkCommand)
+      {
+        BenchmarkResults lvResults;
+        char lvJson[384];
+        MSG_DBG("Running benchmark (%d iterations)...", BENCHMARK_ITERATIONS);
+        Benchmark_Run(&lvResults);
+        Benchmark_ToJson(&lvResults, lvJson, sizeof(lvJson));
+        MSG_DBG("Benchmark: %s", lvJson);
+        MQTT_SendRaw(MQTT_TOPIC_BENCHMARK, (uint8_t*)lvJson, strlen(lvJson));
+        g_BenchmarkCommand = false;
+      }
+#endif //BENCHMARK_ENABLED
       break;
     case STATE_GET_ARCHIVE_DATA:
       ArchivePage *lvArchivePage;
@@ -603,7 +513,7 @@ void loop()
             {
               MSG_DBG(" - [%d] Record Date: %02d-%02d-%04d %02d:%02d", j, DATESTAMP_DAY(lvDateStamp), DATESTAMP_MONTH(lvDateStamp), DATESTAMP_YEAR(lvDateStamp), TIMESTAMP_HOUR(lvTimeStamp), TIMESTAMP_MIN(lvTimeStamp));
               char lvTopic[128];
-              snprintf(lvTopic, sizeof(lvTopic), PSTR("%s/%04d%02d%02d_%02d%02d"), MQTT_TOPIC_ARCHIVE, DATESTAMP_YEAR(lvDateStamp), DATESTAMP_MONTH(lvDateStamp), DATESTAMP_DAY(lvDateStamp), TIMESTAMP_HOUR(lvTimeStamp), TIMESTAMP_MIN(lvTimeStamp));
+              Davis_FormatArchiveTopic(lvArchiveRecord, lvTopic, sizeof(lvTopic));
               MQTT_SendRaw(lvTopic, (uint8_t*)lvArchiveRecord, sizeof(ArchiveRecordRevB));          
             }
           }
@@ -618,34 +528,121 @@ void loop()
   
 }
 
-static bool Davis_Init(void)
+static bool Davis_Init(bool inUseCachedIdentity)
 {
   if (Davis_WakeUp())
   {
+    if (inUseCachedIdentity)
+    {
+      // identity was restored from the boot cache, skip the query round-trips
+      MSG_DBG("Davis FWVersion: %s (cached)", g_StationData.FWVersion);
+      MSG_DBG("Davis FWDate: %s (cached)", g_StationData.FWDate);
+      MSG_DBG("Davis RECEIVERS: 0x%02X (cached)", g_StationData.Receivers);
+      return true;
+    }
+    
     char lvTemp[64];
+    bool lvIdentityOk = true;
     if (Davis_SendCommand("NVER", g_StationData.FWVersion, sizeof(g_StationData.FWVersion)))
     {
       MSG_DBG("Davis FWVersion: %s", g_StationData.FWVersion);
     }
+    else
+    {
+      lvIdentityOk = false;
+    }
     if (Davis_SendCommand("VER", g_StationData.FWDate, sizeof(g_StationData.FWDate)))
     {
       MSG_DBG("Davis FWDate: %s", g_StationData.FWDate);
     }
+    else
+    {
+      lvIdentityOk = false;
+    }
 
     if (Davis_SendCommand("RECEIVERS", (char*)&g_StationData.Receivers, sizeof(g_StationData.Receivers)))
     {
       MSG_DBG("Davis RECEIVERS: 0x%02X", g_StationData.Receivers);
     }
+    else
+    {
+      lvIdentityOk = false;
+    }
     if (Davis_SendCommand("RXCHECK", lvTemp, sizeof(lvTemp)))
     {
       MSG_DBG("Davis RXCHECK: %s", lvTemp);
     }
     Davis_GetTime();
+    if (!lvIdentityOk)
+    {
+      MSG_DBG("Davis identity incomplete!");
+    }
+#ifdef FAST_BOOT_ENABLED
+    if (lvIdentityOk)
+    {
+      BootCache_Update();
+    }
+#endif //FAST_BOOT_ENABLED
     return true;
   }
   return false;
 }
 
+#ifdef FAST_BOOT_ENABLED
+static bool BootCache_IsWarmReset(uint8_t inResetReason)
+{
+  // on power-on or external reset the console may have changed, so only trust the cache after a restart of the ESP itself
+  return ((inResetReason == REASON_WDT_RST) || 
+          (inResetReason == REASON_EXCEPTION_RST) || 
+          (inResetReason == REASON_SOFT_WDT_RST) || 
+          (inResetReason == REASON_SOFT_RESTART));
+}
+
+static bool BootCache_Load(void)
+{
+  // note: called before the debug serial is up, so no debug output here
+  EEPROM.get(0, s_BootCache);
+  if ((s_BootCache.Magic != FAST_BOOT_CACHE_MAGIC) || (CalcCrc((uint8_t*)&s_BootCache, offsetof(BootCache, CRC)) != s_BootCache.CRC))
+  {
+    memset(&s_BootCache, 0, sizeof(s_BootCache));
+    return false;
+  }
+  return true;
+}
+
+static void BootCache_Apply(bool inApplyIdentity)
+{
+  if (inApplyIdentity)
+  {
+    memcpy(g_StationData.FWDate, s_BootCache.FWDate, sizeof(g_StationData.FWDate));
+    memcpy(g_StationData.FWVersion, s_BootCache.FWVersion, sizeof(g_StationData.FWVersion));
+    g_StationData.Receivers = s_BootCache.Receivers;
+  }
+  g_Settings = s_BootCache.UserSettings;
+}
+
+static void BootCache_Update(void)
+{
+  BootCache lvBootCache;
+  memset(&lvBootCache, 0, sizeof(lvBootCache));
+  lvBootCache.Magic = FAST_BOOT_CACHE_MAGIC;
+  memcpy(lvBootCache.FWDate, g_StationData.FWDate, sizeof(lvBootCache.FWDate));
+  memcpy(lvBootCache.FWVersion, g_StationData.FWVersion, sizeof(lvBootCache.FWVersion));
+  lvBootCache.Receivers = g_StationData.Receivers;
+  lvBootCache.UserSettings = g_Settings;
+  lvBootCache.CRC = CalcCrc((uint8_t*)&lvBootCache, offsetof(BootCache, CRC));
+
+  // only write to flash if something actually changed
+  if (memcmp(&lvBootCache, &s_BootCache, sizeof(BootCache)) != 0)
+  {
+    memcpy(&s_BootCache, &lvBootCache, sizeof(BootCache));
+    EEPROM.put(0, s_BootCache);
+    EEPROM.commit();
+    MSG_DBG("Boot cache updated.");
+  }
+}
+#endif //FAST_BOOT_ENABLED
+
 static bool Davis_GetTime(uint16_t *outYear, uint8_t *outMonth, uint8_t *outDay, uint8_t *outHours, uint8_t *outMinutes, uint8_t *outSeconds)
 {
   uint8_t lvPacket[8];
@@ -1051,63 +1048,3 @@ static bool Davis_WakeUp(void)
   //MSG_DBG("Wake-up successful!");
   return true;
 }
-
-static bool Davis_ConvertLoopData(LoopPacket* inLoopPacket, StationData * outStationData)
-{
-  outStationData->InsideTemperature  = DAVIS_CONVERT_TEMPERATURE_10TH(inLoopPacket->InTemperature);
-  outStationData->OutsideTemperature = DAVIS_CONVERT_TEMPERATURE_10TH(inLoopPacket->OutTemperature);
-   
-  outStationData->BarometricPressure = DAVIS_CONVERT_BAR_PRESSURE(inLoopPacket->Barometer);
-  outStationData->BarometricTrend = inLoopPacket->BarTrend;
-  outStationData->InsideHumidity = inLoopPacket->InHumidity;
-  outStationData->OutsideHumidity = inLoopPacket->OutHumidity;
-
-  outStationData->WindSpeed = DAVIS_CONVERT_WINDSPEED(inLoopPacket->WindSpeed);
-  outStationData->AvgWindSpeed = DAVIS_CONVERT_WINDSPEED(inLoopPacket->AvgWindSpeed);
-  
-  outStationData->WindDirection = inLoopPacket->WindDirection;
-
-  for (int i = 0; i < 7; i++)
-  {
-    outStationData->ExtraTemps[i] = DAVIS_CONVERT_EXTRA_TEMPERATURE(inLoopPacket->ExtraTemps[i]);
-  }
-  for (int i = 0; i < 4; i++)
-  {
-    outStationData->SoilTemps[i] = DAVIS_CONVERT_EXTRA_TEMPERATURE(inLoopPacket->SoilTemps[i]);
-  }
-  for (int i = 0; i < 4; i++)
-  {
-    outStationData->LeafTemps[i] = DAVIS_CONVERT_EXTRA_TEMPERATURE(inLoopPacket->LeafTemps[i]);
-  }
-  for (int i = 0; i < 7; i++)
-  {
-    outStationData->ExtraHumidity[i] = inLoopPacket->ExtraHumidity[i];
-  }
-  outStationData->RainRate = DAVIS_CONVERT_RAINRATE(inLoopPacket->RainRate);
-  outStationData->RainDaily = DAVIS_CONVERT_RAINRATE(inLoopPacket->RainDay);
-  
-  outStationData->UVindex = inLoopPacket->UVindex;
-  outStationData->SolarRadiation = inLoopPacket->SolarRadiation;
-
-  outStationData->Battery_Transmitter = inLoopPacket->Battery_Transmitter;
-  outStationData->Battery_Console = DAVIS_CONVERT_BATT_VOLTAGE(inLoopPacket->Battery_Console);
-
-  outStationData->ForecastIcons = inLoopPacket->ForecastIcons;
-  outStationData->ForecastRule = inLoopPacket->ForecastRule;
-
-  snprintf(outStationData->TimeSunrise, sizeof(outStationData->TimeSunrise), "%02d:%02d", (inLoopPacket->TimeSunrise / 100), inLoopPacket->TimeSunrise % 100);
-  snprintf(outStationData->TimeSunset, sizeof(outStationData->TimeSunset), "%02d:%02d", (inLoopPacket->TimeSunset / 100), inLoopPacket->TimeSunset % 100);
-  return true;
-}
-
-static bool Davis_ConvertLoop2Data(Loop2Packet* inLoop2Packet, StationData * outStationData)
-{
-  outStationData->DewPoint = DAVIS_CONVERT_DEW_POINT(inLoop2Packet->DewPoint);
-  outStationData->WindChillTemp = DAVIS_CONVERT_DEW_POINT(inLoop2Packet->WindChill);
- 
-  outStationData->Rain15min = DAVIS_CONVERT_RAINRATE(inLoop2Packet->Rain15Min);
-  outStationData->RainHour = DAVIS_CONVERT_RAINRATE(inLoop2Packet->RainHour);
-  outStationData->Rain24Hrs = DAVIS_CONVERT_RAINRATE(inLoop2Packet->Rain24Hrs);
-  
-  return true;
-}
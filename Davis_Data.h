@@ -0,0 +1,202 @@
+#ifndef DAVIS_DATA_H
+#define DAVIS_DATA_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+/*** DEFINES ***/
+// Data conversion macros
+#define DAVIS_CONVERT_TEMPERATURE_10TH(raw)      (((((float)raw / 10.0f) - 32.0f) * 5.0f) / 9.0f)
+#define DAVIS_CONVERT_EXTRA_TEMPERATURE(raw)     (((((float)raw - 90.0f) - 32.0f) * 5.0f) / 9.0f)
+#define DAVIS_CONVERT_WINDSPEED(mph)             ((float)mph * 1.609344f)
+#define DAVIS_CONVERT_RAINRATE(clicks)           ((float)clicks * 0.2f)
+#define DAVIS_CONVERT_BATT_VOLTAGE(raw)          ((((float)raw * 300.0f)/512.0f)/100.0)
+#define DAVIS_CONVERT_BAR_PRESSURE(raw)          ((((float)raw * 33.86389f) / 1000.0))
+#define DAVIS_CONVERT_DEW_POINT(raw)             ((((float)raw - 32.0f) * 5.0f) / 9.0f)
+
+
+#define DATE_TO_DATESTAMP(d,m,y)      (uint16_t)((uint16_t)d + m*32 + (y-2000)*512)
+#define TIME_TO_TIMESTAMP(h,m)        (uint16_t)((uint16_t)h*100 + m)
+
+#define DATESTAMP_DAY(ds)             (uint8_t)(ds & 0x1F)
+#define DATESTAMP_MONTH(ds)           (uint8_t)((ds >> 5) & 0x0F)
+#define DATESTAMP_YEAR(ds)            (uint16_t)(((ds >> 9) & 0x7F) + 2000)
+#define TIMESTAMP_HOUR(ts)            (uint8_t)(ts/100)
+#define TIMESTAMP_MIN(ts)             (uint8_t)(ts - (100*(ts/100)))
+
+/*** TYPE DEFINITIONS ***/
+#pragma pack(push)
+#pragma pack(1)
+typedef struct 
+{
+  uint8_t Seconds;
+  uint8_t Minutes;
+  uint8_t Hours;
+  uint8_t Day;
+  uint8_t Month;
+  uint8_t Year;
+  uint16_t CRC;
+} TimePacket;
+
+typedef struct 
+{
+  uint8_t   Identifier[3];  // 0
+  uint8_t   BarTrend;       // 3
+  uint8_t   PacketType;     // 4
+  uint16_t  NextRecord;     // 5
+  int16_t   Barometer;      // 7
+  int16_t   InTemperature;  // 9
+  uint8_t   InHumidity;     // 11
+  int16_t   OutTemperature; // 12
+  uint8_t   WindSpeed;      // 14
+  uint8_t   AvgWindSpeed;   // 15
+  uint16_t  WindDirection;  // 16
+  uint8_t   ExtraTemps[7];  // 18
+  uint8_t   SoilTemps[4];   // 25
+  uint8_t   LeafTemps[4];   // 29
+  uint8_t   OutHumidity;    // 33
+  uint8_t   ExtraHumidity[7];// 34
+  uint16_t  RainRate;       // 41
+  uint8_t   UVindex;        // 42
+  uint16_t  SolarRadiation; // 44
+  uint16_t  StormRain;      // 46
+  uint16_t  StormDate;      // 48
+  uint16_t  RainDay;        // 50
+  uint16_t  RainMonth;      // 52
+  uint16_t  RainYear;       // 54
+  uint16_t  ET_Day;         // 56
+  uint16_t  ET_Month;       // 58
+  uint16_t  ET_Year;        // 60
+  uint8_t   SoilMoisture[4];// 62
+  uint8_t   LeafWetness[4]; // 66
+  uint8_t   Alarms_Inside;  // 70
+  uint8_t   Alarms_Rain;            // 71
+  uint8_t   Alarms_Outside[2];      // 72
+  uint8_t   Alarms_ExtraTempHum[8]; // 74
+  uint8_t   Alarms_SoilLeaf[4];     // 82
+  uint8_t   Battery_Transmitter;    // 86
+  uint16_t  Battery_Console;        // 87
+  uint8_t   ForecastIcons;          // 89
+  uint8_t   ForecastRule;           // 90
+  uint16_t  TimeSunrise;            // 91
+  uint16_t  TimeSunset;             // 93
+  uint8_t   LF;                     // 95
+  uint8_t   CR;                     // 96
+  uint16_t  CRC;                    // 97
+} LoopPacket;
+
+typedef struct 
+{
+  uint8_t   Identifier[3];  // 0
+  uint8_t   BarTrend;       // 3
+  uint8_t   PacketType;     // 4
+  uint16_t  Unused;         // 5
+  int16_t   Barometer;      // 7
+  int16_t   InTemperature;  // 9
+  uint8_t   InHumidity;     // 11
+  int16_t   OutTemperature; // 12
+  uint8_t   WindSpeed;      // 14
+  uint8_t   Unused2;        // 15
+  uint16_t  WindDirection;  // 16
+  uint16_t  AvgWindSpeed10; // 18
+  uint16_t  AvgWindSpeed2;  // 20
+  uint16_t  AvgWindGust;    // 22
+  uint16_t  WindGustDirection;   // 24
+  uint8_t   Unused3[4];     // 26
+  int16_t   DewPoint;       // 30
+  uint8_t   Unused4;        // 32
+  uint8_t   OutHumidity;    // 33
+  uint8_t   Unused5;        // 34
+  int16_t   HeatIndex;      // 35
+  int16_t   WindChill;      // 37
+  int16_t   THSWIndex;      // 39
+  uint16_t  RainRate;       // 41
+  uint8_t   UVindex;        // 42
+  uint16_t  SolarRadiation; // 44
+  uint16_t  StormRain;      // 46
+  uint16_t  StormDate;      // 48
+  uint16_t  RainDay;        // 50
+  uint16_t  Rain15Min;      // 52
+  uint16_t  RainHour;       // 54
+  uint16_t  ET_Day;         // 56
+  uint16_t  Rain24Hrs;      // 58
+  uint8_t   BarReduction;   // 60
+  uint16_t  BarOffset;      // 61
+  uint16_t  BarCalibNr;     // 63
+  uint16_t  BarRaw;         // 65
+  uint16_t  BarAbs;         // 67
+  uint16_t  Altimeter;      // 69
+  uint8_t   Unused6[2];     // 71
+  uint8_t   Next10minWindGPtr;    // 73
+  uint8_t   Next15minWindGPtr;    // 74
+  uint8_t   NextHourlyWindGPtr;   // 75
+  uint8_t   NextDailyWindGPtr;    // 76
+  uint8_t   NextMinuteRainGPtr;   // 77
+  uint8_t   NextStormRainGPtr;    // 78
+  uint8_t   MinuteIndex;          // 79
+  uint8_t   NextMonthlyRain;      // 80
+  uint8_t   NextYearlyRain;       // 81
+  uint8_t   NextSeasonalRain;     // 82
+  uint8_t   Unused7[2*6];         // 83
+  uint8_t   LF;                     // 95
+  uint8_t   CR;                     // 96
+  uint16_t  CRC;                    // 97
+} Loop2Packet;
+
+typedef struct 
+{
+  uint16_t  DateStamp;      // 0
+  uint16_t  TimeStamp;      // 2
+  int16_t   OutTemperature; // 4
+  int16_t   OutTempHigh;    // 6
+  int16_t   OutTempLow;     // 8
+  uint16_t  RainFall;       // 10
+  uint16_t  HighRainRate;   // 12
+  uint16_t  Barometer;      // 14
+  uint16_t  SolarRadiation; // 16
+  uint16_t  WindSamples;    // 18
+  int16_t   InTemperature;  // 20
+  uint8_t   InHumidity;     // 22
+  uint8_t   OutHumidity;    // 23
+  uint8_t   AvgWindSpeed;   // 24
+  uint8_t   HighWindSpeed;  // 25
+  uint8_t   HighWindDirection;  // 26
+  uint8_t   PrevWindDirection;  // 27
+  uint8_t   AvgUVIndex;     // 28
+  uint8_t   ET;             // 29
+  uint16_t  HighSolarRadiation; // 30
+  uint8_t   HighUVIndex;    // 32
+  uint8_t   ForecastRule;   // 33
+  uint8_t   LeafTemp[2];    // 34
+  uint8_t   LeafWetness[2]; // 36
+  uint8_t   SoilTemp[4];    // 38
+  uint8_t   RecordType;     // 42
+  uint8_t   ExtraHum[2];    // 43
+  uint8_t   ExtraTemp[3];   // 45
+  uint8_t   SoilMoisture[4];// 48
+} ArchiveRecordRevB;
+
+typedef struct 
+{
+  uint8_t           SeqNr;      // 0
+  ArchiveRecordRevB Record[5];  // 1
+  uint8_t           Unused[4];  // 261
+  uint16_t          CRC;        // 265
+} ArchivePage;
+
+#pragma pack(pop)
+
+// sizes of the console packets on the wire
+static_assert(sizeof(TimePacket) == 8, "TimePacket size mismatch");
+static_assert(sizeof(LoopPacket) == 99, "LoopPacket size mismatch");
+static_assert(sizeof(Loop2Packet) == 99, "Loop2Packet size mismatch");
+static_assert(sizeof(ArchiveRecordRevB) == 52, "ArchiveRecordRevB size mismatch");
+static_assert(sizeof(ArchivePage) == 267, "ArchivePage size mismatch");
+
+/*** PUBLIC FUNCTIONS ***/
+uint16_t CalcCrc(uint8_t * inDataPtr, uint16_t inSize);
+bool Davis_ConvertLoopData(LoopPacket* inLoopPacket, StationData * outStationData);
+bool Davis_ConvertLoop2Data(Loop2Packet* inLoop2Packet, StationData * outStationData);
+void Davis_FormatArchiveTopic(const ArchiveRecordRevB *inArchiveRecord, char *outTopic, uint16_t inMaxLength);
+
+#endif //DAVIS_DATA_H
@@ -0,0 +1,91 @@
+/*** INCLUDES ***/
+#include "MQTT_Payload.h"
+
+#ifdef WIFI_ENABLED
+
+#include <stdio.h>
+#include <string.h>
+
+/*** PUBLIC FUNCTIONS ***/
+void MQTT_FillState(JsonObject& outRoot, const StationData *inStationData, unsigned long inEpochTime)
+{
+  if (inEpochTime != 0)
+  {
+    outRoot["Time"]              = inEpochTime;
+  }
+
+  outRoot["InsideTemperature"]   = inStationData->InsideTemperature;
+  outRoot["InsideHumidity"]      = inStationData->InsideHumidity;
+  outRoot["OutsideTemperature"]  = inStationData->OutsideTemperature;
+  outRoot["OutsideHumidity"]     = inStationData->OutsideHumidity;
+  
+  outRoot["BarPressure"]         = inStationData->BarometricPressure;
+  outRoot["BarTrend"]            = inStationData->BarometricTrend;
+  outRoot["DewPoint"]            = inStationData->DewPoint;
+  
+//  outRoot["WindSpeed"]           = inStationData->WindSpeed;
+//  outRoot["AvgWindSpeed"]        = inStationData->AvgWindSpeed;
+//  outRoot["WindDirection"]       = inStationData->WindDirection;
+//  outRoot["WindChill"]           = inStationData->WindChillTemp;
+/*
+  JsonArray& lvExtraTemperatures = outRoot.createNestedArray("ExtraTemps");
+  for (int i = 0; i < 7; i++)
+  {
+    lvExtraTemperatures.add(inStationData->ExtraTemps[i]);
+  }
+  JsonArray& lvExtraHumidity = outRoot.createNestedArray("ExtraHumidity");
+  for (int i = 0; i < 7; i++)
+  {
+    lvExtraHumidity.add(inStationData->ExtraHumidity[i]);
+  }
+  
+  JsonArray& lvSoilTemps = outRoot.createNestedArray("SoilTemps");
+  for (int i = 0; i < 4; i++)
+  {
+    lvSoilTemps.add(inStationData->SoilTemps[i]);
+  }
+
+  JsonArray& lvLeafTemps = outRoot.createNestedArray("LeafTemps");
+  for (int i = 0; i < 4; i++)
+  {
+    lvLeafTemps.add(inStationData->LeafTemps[i]);
+  }
+*/
+  outRoot["RainRate"]            = inStationData->RainRate;
+//  outRoot["Rain15min"]           = inStationData->Rain15min;
+//  outRoot["RainHour"]            = inStationData->RainHour;
+  outRoot["Rain24Hrs"]           = inStationData->Rain24Hrs;
+  outRoot["RainDaily"]           = inStationData->RainDaily;
+  
+//  outRoot["UVindex"]             = inStationData->UVindex;
+//  outRoot["SolarRadiation"]      = inStationData->SolarRadiation;
+//  outRoot["Battery_Transmitter"] = inStationData->Battery_Transmitter;
+//  outRoot["Battery_Console"]     = inStationData->Battery_Console;
+  outRoot["ForecastIcons"]       = inStationData->ForecastIcons;
+//  outRoot["ForecastRule"]        = inStationData->ForecastRule;
+//  outRoot["TimeSunrise"]         = inStationData->TimeSunrise;
+//  outRoot["TimeSunset"]          = inStationData->TimeSunset;
+}
+
+bool MQTT_ParseDateTimeCommand(const char* inMessage, const char* inCommand, DateTimeStruct* outDateTime)
+{
+  // the caller matched the command on the raw payload only, so check it again before skipping it
+  if (strncmp(inMessage, inCommand, strlen(inCommand)) != 0)
+  {
+    return false;
+  }
+  int lvArgs[6];
+  if (sscanf(inMessage + strlen(inCommand), " %d-%d-%d %d:%d:%d", &lvArgs[0], &lvArgs[1], &lvArgs[2], &lvArgs[3], &lvArgs[4], &lvArgs[5]) == 6)
+  {
+    outDateTime->Year = (uint16_t)lvArgs[0];
+    outDateTime->Month = (uint8_t)lvArgs[1];
+    outDateTime->Day = (uint8_t)lvArgs[2];
+    outDateTime->Hours = (uint8_t)lvArgs[3];
+    outDateTime->Minutes = (uint8_t)lvArgs[4];
+    outDateTime->Seconds = (uint8_t)lvArgs[5];
+    return true;
+  }
+  return false;
+}
+
+#endif // WIFI_ENABLED
@@ -0,0 +1,20 @@
+#ifndef MQTT_PAYLOAD_H
+#define MQTT_PAYLOAD_H
+
+/*** INCLUDES ***/
+#include "Settings.h"
+
+#ifdef WIFI_ENABLED
+
+#include <ArduinoJson.h>
+
+// JSON Settings
+const int JSON_BUFFER_SIZE = JSON_OBJECT_SIZE(50);
+
+// inEpochTime = 0 leaves out the "Time" field
+void MQTT_FillState(JsonObject& outRoot, const StationData *inStationData, unsigned long inEpochTime);
+bool MQTT_ParseDateTimeCommand(const char* inMessage, const char* inCommand, DateTimeStruct* outDateTime);
+
+#endif // WIFI_ENABLED
+
+#endif //MQTT_PAYLOAD_H
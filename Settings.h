@@ -8,6 +8,8 @@
 #define DEVICETYPE      "WeatherStation"
 #define WIFI_ENABLED
 #define NTP_ENABLED
+//#define FAST_BOOT_ENABLED
+//#define BENCHMARK_ENABLED
 
 /*** WIFI/MQTT Settings ***/
 #ifdef WIFI_ENABLED  
@@ -39,10 +41,15 @@
 
   #define MQTT_TOPIC_ARCHIVE                    DEVICETYPE "/" DEVICENAME "/archive"  
 
+  #define MQTT_TOPIC_BOOT                       DEVICETYPE "/" DEVICENAME "/boot"
+  #define MQTT_TOPIC_BENCHMARK                  DEVICETYPE "/" DEVICENAME "/benchmark"
+
   #define MQTT_CMD_GET_ARCHIVE                  "get_archive"
 
   #define MQTT_CMD_GET_TIME                     "get_time"
   #define MQTT_CMD_SET_TIME                     "set_time"
+
+  #define MQTT_CMD_BENCHMARK                    "benchmark"
   
   //#define MQTT_TOPIC_GROUP                      DEVICETYPE "/" GROUPNAME
   //#define MQTT_HOMEASSISTANT_DISCOVERY_PREFIX   "homeassistant"
@@ -65,6 +72,25 @@
 
 #define NTP_UPDATE_INTERVAL_MS    (4UL*60*60*1000)
 
+/*** Fast Boot Settings ***/
+#ifdef FAST_BOOT_ENABLED
+  // After a warm reset (OTA, watchdog, exception) the console identity and settings are
+  // restored from flash instead of being queried from the console.
+  #define FAST_BOOT_CACHE_MAGIC     0x44564331UL    // "DVC1", change when the cache layout changes
+  #define FAST_BOOT_SETTLE_MS       100             // RS232 transceiver power-up delay on warm reset
+  #define FAST_BOOT_MQTT_WAIT_MS    15000           // max. time the first LOOP sample waits for MQTT
+#endif //FAST_BOOT_ENABLED
+
+/*** Benchmark Settings ***/
+#ifdef BENCHMARK_ENABLED
+  // Times each stage of the per-sample path, see Benchmark.h. On the target it is triggered by
+  // MQTT_CMD_BENCHMARK, the host build in bench/ runs the same stages with more iterations.
+  #ifndef BENCHMARK_ITERATIONS
+    #define BENCHMARK_ITERATIONS    200
+  #endif //BENCHMARK_ITERATIONS
+  #define BENCHMARK_SEED            0x5EEDUL        // fixed seed for the synthetic input packets
+#endif //BENCHMARK_ENABLED
+
 /*** General Settings ***/
 
 typedef struct {
@@ -129,6 +155,21 @@ typedef struct
 
 extern StationData g_StationData;
 
+typedef struct
+{
+  uint8_t   ResetReason;
+  bool      FastBoot;
+  uint32_t  ConsoleReadyMs;   // millis() when Davis init completed
+  uint32_t  MqttReadyMs;      // millis() when the first MQTT connection was established
+  uint32_t  FirstPublishMs;   // millis() when the first LOOP sample was published, without the usual pacing delays
+} BootMetrics;
+
+extern BootMetrics g_BootMetrics;
+
+#ifdef BENCHMARK_ENABLED
+extern bool g_BenchmarkCommand;
+#endif //BENCHMARK_ENABLED
+
 #define CMD_MAX_SIZE        64
 #define CMD_RESP_MAX_SIZE   512
 
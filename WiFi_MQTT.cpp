@@ -4,6 +4,7 @@
 #ifdef WIFI_ENABLED
 
 #include <ArduinoJson.h>
+#include "MQTT_Payload.h"
 #ifdef ESP8266
   #include <ESP8266WiFi.h>
 #endif
@@ -36,9 +37,6 @@
 #define MS_TIMER_START(tim)               tim = millis();
 #define MS_TIMER_ELAPSED(tim, delay)      ((millis() - tim) >= delay)
 
-// JSON Settings
-const int JSON_BUFFER_SIZE = JSON_OBJECT_SIZE(50);
-
 
 /*** TYPE DEFINITIONS ***/
 typedef enum {
@@ -146,6 +144,10 @@ void WiFi_MQTT_Tick()
                   #endif //MQTT_TOPIC_CMD_RAW
                   
                   MQTT_SetOnline(true);
+                  if (g_BootMetrics.MqttReadyMs == 0)
+                  {
+                    g_BootMetrics.MqttReadyMs = millis();
+                  }
                   
                   #ifdef MQTT_HOMEASSISTANT_DISCOVERY
                     delay(10);
@@ -189,6 +191,12 @@ void WiFi_MQTT_Tick()
         #endif //NTP_ENABLED
     }
 }
+
+bool WiFi_MQTT_IsConnected(void)
+{
+  return (s_State == STATE_WIFI_MQTT_CONNECTED);
+}
+
 #ifdef NTP_ENABLED
 const char * WiFi_MQTT_GetTime(void)
 {
@@ -222,7 +230,7 @@ void MQTT_SendConfig()
   }
 }
 
-void MQTT_SendState() 
+bool MQTT_SendState() 
 {
   if (s_MQTTClient.connected())
   {
@@ -231,69 +239,44 @@ void MQTT_SendState()
     JsonObject& lvRoot = lvJSONBuffer.createObject();
 
 #ifdef NTP_ENABLED
-    lvRoot["Time"]                = s_NTP_Client.getEpochTime();//WiFi_MQTT_GetTime();
-#endif //NTP_ENABLED 
+    MQTT_FillState(lvRoot, &g_StationData, s_NTP_Client.getEpochTime());
+#else
+    MQTT_FillState(lvRoot, &g_StationData, 0);
+#endif //NTP_ENABLED
 
-    lvRoot["InsideTemperature"]   = g_StationData.InsideTemperature;
-    lvRoot["InsideHumidity"]      = g_StationData.InsideHumidity;
-    lvRoot["OutsideTemperature"]  = g_StationData.OutsideTemperature;
-    lvRoot["OutsideHumidity"]     = g_StationData.OutsideHumidity;
-    
-    lvRoot["BarPressure"]         = g_StationData.BarometricPressure;
-    lvRoot["BarTrend"]            = g_StationData.BarometricTrend;
-    lvRoot["DewPoint"]            = g_StationData.DewPoint;
-    
-//    lvRoot["WindSpeed"]           = g_StationData.WindSpeed;
-//    lvRoot["AvgWindSpeed"]        = g_StationData.AvgWindSpeed;
-//    lvRoot["WindDirection"]       = g_StationData.WindDirection;
-//    lvRoot["WindChill"]           = g_StationData.WindChillTemp;
-/*
-    JsonArray& lvExtraTemperatures = lvRoot.createNestedArray("ExtraTemps");
-    for (int i = 0; i < 7; i++)
-    {
-      lvExtraTemperatures.add(g_StationData.ExtraTemps[i]);
-    }
-    JsonArray& lvExtraHumidity = lvRoot.createNestedArray("ExtraHumidity");
-    for (int i = 0; i < 7; i++)
-    {
-      lvExtraHumidity.add(g_StationData.ExtraHumidity[i]);
-    }
-    
-    JsonArray& lvSoilTemps = lvRoot.createNestedArray("SoilTemps");
-    for (int i = 0; i < 4; i++)
-    {
-      lvSoilTemps.add(g_StationData.SoilTemps[i]);
-    }
+    char lvBuffer[lvRoot.measureLength() + 1];
+    lvRoot.printTo(lvBuffer, sizeof(lvBuffer));
+  
+    MSG_DBG("JSON Status: %s", lvBuffer);
+  
+    MSG_DBG("Publish to topic: %s", MQTT_TOPIC_STATE);
+  
+    return s_MQTTClient.publish(MQTT_TOPIC_STATE, lvBuffer, true);
+  }
+  return false;
+}
 
-    JsonArray& lvLeafTemps = lvRoot.createNestedArray("LeafTemps");
-    for (int i = 0; i < 4; i++)
-    {
-      lvLeafTemps.add(g_StationData.LeafTemps[i]);
-    }
-*/
-    lvRoot["RainRate"]            = g_StationData.RainRate;
-//    lvRoot["Rain15min"]           = g_StationData.Rain15min;
-//    lvRoot["RainHour"]            = g_StationData.RainHour;
-    lvRoot["Rain24Hrs"]           = g_StationData.Rain24Hrs;
-    lvRoot["RainDaily"]           = g_StationData.RainDaily;
+void MQTT_SendBootMetrics() 
+{
+  if (s_MQTTClient.connected())
+  {
+    StaticJsonBuffer<JSON_BUFFER_SIZE> lvJSONBuffer;
   
-//    lvRoot["UVindex"]             = g_StationData.UVindex;
-//    lvRoot["SolarRadiation"]      = g_StationData.SolarRadiation;
-//    lvRoot["Battery_Transmitter"] = g_StationData.Battery_Transmitter;
-//    lvRoot["Battery_Console"]     = g_StationData.Battery_Console;
-    lvRoot["ForecastIcons"]       = g_StationData.ForecastIcons;
-//    lvRoot["ForecastRule"]        = g_StationData.ForecastRule;
-//    lvRoot["TimeSunrise"]         = g_StationData.TimeSunrise;
-//    lvRoot["TimeSunset"]          = g_StationData.TimeSunset;
+    JsonObject& lvRoot = lvJSONBuffer.createObject();
+    lvRoot["ResetReason"]         = g_BootMetrics.ResetReason;
+    lvRoot["FastBoot"]            = g_BootMetrics.FastBoot;
+    lvRoot["ConsoleReadyMs"]      = g_BootMetrics.ConsoleReadyMs;
+    lvRoot["MqttReadyMs"]         = g_BootMetrics.MqttReadyMs;
+    lvRoot["FirstPublishMs"]      = g_BootMetrics.FirstPublishMs;
   
     char lvBuffer[lvRoot.measureLength() + 1];
     lvRoot.printTo(lvBuffer, sizeof(lvBuffer));
   
-    MSG_DBG("JSON Status: %s", lvBuffer);
+    MSG_DBG("JSON Boot: %s", lvBuffer);
   
-    MSG_DBG("Publish to topic: %s", MQTT_TOPIC_STATE);
+    MSG_DBG("Publish to topic: %s", MQTT_TOPIC_BOOT);
   
-    s_MQTTClient.publish(MQTT_TOPIC_STATE, lvBuffer, true);
+    s_MQTTClient.publish(MQTT_TOPIC_BOOT, lvBuffer, true);
   }
 }
 
@@ -385,15 +368,8 @@ static void MQTT_Callback(char* inTopic, byte* inPayload, unsigned int inLength)
       char lvTempString[inLength+1];
       memcpy(lvTempString, inPayload, inLength);
       lvTempString[inLength] = '\0';
-      int lvArgs[6];
-      if (sscanf(lvTempString, MQTT_CMD_GET_ARCHIVE" %d-%d-%d %d:%d:%d", &lvArgs[0], &lvArgs[1], &lvArgs[2], &lvArgs[3], &lvArgs[4], &lvArgs[5]) == 6)
+      if (MQTT_ParseDateTimeCommand(lvTempString, MQTT_CMD_GET_ARCHIVE, &g_DateTimeStruct))
       {
-        g_DateTimeStruct.Year = (uint16_t)lvArgs[0];
-        g_DateTimeStruct.Month = (uint8_t)lvArgs[1];
-        g_DateTimeStruct.Day = (uint8_t)lvArgs[2];
-        g_DateTimeStruct.Hours = (uint8_t)lvArgs[3];
-        g_DateTimeStruct.Minutes = (uint8_t)lvArgs[4];
-        g_DateTimeStruct.Seconds = (uint8_t)lvArgs[5];
         // valid time stamp given command
         g_TriggerArchiveDownloadWithDateTime = true;
       }
@@ -412,15 +388,8 @@ static void MQTT_Callback(char* inTopic, byte* inPayload, unsigned int inLength)
       char lvTempString[inLength+1];
       memcpy(lvTempString, inPayload, inLength);
       lvTempString[inLength] = '\0';
-      int lvArgs[6];
-      if (sscanf(lvTempString, MQTT_CMD_SET_TIME" %d-%d-%d %d:%d:%d", &lvArgs[0], &lvArgs[1], &lvArgs[2], &lvArgs[3], &lvArgs[4], &lvArgs[5]) == 6)
+      if (MQTT_ParseDateTimeCommand(lvTempString, MQTT_CMD_SET_TIME, &g_DateTimeStruct))
       {
-        g_DateTimeStruct.Year = (uint16_t)lvArgs[0];
-        g_DateTimeStruct.Month = (uint8_t)lvArgs[1];
-        g_DateTimeStruct.Day = (uint8_t)lvArgs[2];
-        g_DateTimeStruct.Hours = (uint8_t)lvArgs[3];
-        g_DateTimeStruct.Minutes = (uint8_t)lvArgs[4];
-        g_DateTimeStruct.Seconds = (uint8_t)lvArgs[5];
         // valid set time command
         g_SetTimeCommand = true;
       }
@@ -429,6 +398,13 @@ static void MQTT_Callback(char* inTopic, byte* inPayload, unsigned int inLength)
         MSG_DBG("Invalid "MQTT_CMD_SET_TIME" command!");
       }
     }
+#ifdef BENCHMARK_ENABLED
+    else if (memcmp(inPayload, MQTT_CMD_BENCHMARK, strlen(MQTT_CMD_BENCHMARK)) == 0)
+    {
+      // benchmark command
+      g_BenchmarkCommand = true;
+    }
+#endif //BENCHMARK_ENABLED
   }  
 #endif //MQTT_TOPIC_CMD
 }
@@ -7,13 +7,15 @@
 
 void WiFi_MQTT_Init(void);
 void WiFi_MQTT_Tick(void);
+bool WiFi_MQTT_IsConnected(void);
 
 #ifdef NTP_ENABLED
  const char *WiFi_MQTT_GetTime(void);
 #endif // NTP_ENABLED
         
 void MQTT_SendConfig(void);
-void MQTT_SendState(void);
+bool MQTT_SendState(void);
+void MQTT_SendBootMetrics(void);
  
 void MQTT_SendRaw(const char* inTopic, uint8_t *inData, uint16_t inLength);
 
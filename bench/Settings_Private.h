@@ -0,0 +1,8 @@
+// Placeholder credentials for the host benchmark build, the sketch uses the real Settings_Private.h
+#define WIFI_SSID         "wifi_ssid"
+#define WIFI_PASS         "wifi_pass"
+
+#define MQTT_SERVER       "mqtt_ip"
+#define MQTT_USERNAME     "mqtt_user"
+#define MQTT_PASSWORD     "mqtt_pass"
+#define MQTT_PORT         1883
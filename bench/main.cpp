@@ -0,0 +1,15 @@
+/*** INCLUDES ***/
+#include <stdio.h>
+#include "Benchmark.h"
+
+// Host build of the per-sample benchmark, prints the results as one JSON line on stdout.
+int main(void)
+{
+  BenchmarkResults lvResults;
+  char lvJson[512];
+
+  Benchmark_Run(&lvResults);
+  Benchmark_ToJson(&lvResults, lvJson, sizeof(lvJson));
+  printf("%s\n", lvJson);
+  return 0;
+}